@@ -1,5 +1,8 @@
 #!/bin/bash
 
+#alternatively leave ROCR_VISIBLE_DEVICES unset and select the device with
+#the ranksPerDevice OptimisationSwitch (etc/controlDict)
+
 #assume server has 8 GPUs
 let NGPUS=8
 